@@ -36,6 +36,14 @@
 #define SOL_NETLINK 270
 #endif
 
+#ifndef NETLINK_CAP_ACK
+#define NETLINK_CAP_ACK 10
+#endif
+
+#ifndef NETLINK_EXT_ACK
+#define NETLINK_EXT_ACK 11
+#endif
+
 #include <linux/types.h>
 
 /* local header copies */
@@ -164,6 +172,136 @@ static inline void rtnl_rcopy_ratespec(struct tc_ratespec *dst,
 	dst->rate = src->rs_rate;
 }
 
+#define NL_HASH_INIT	0xcbf29ce484222325ULL
+
+/* FNV-1a, used for object content hashes */
+static inline uint64_t nl_hash_update(uint64_t hash, const void *data,
+				      size_t len)
+{
+	const unsigned char *p = data;
+
+	while (len--) {
+		hash ^= *p++;
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+static inline unsigned int nl_msgtype_hash(int protocol, int msgtype)
+{
+	return ((unsigned int) protocol * 31 + msgtype) % NL_MSGTYPE_HASH_SIZE;
+}
+
+static inline unsigned int nl_cache_ops_hash(const char *name)
+{
+	return nl_hash_update(NL_HASH_INIT, name, strlen(name))
+		% NL_CACHE_OPS_HASH_SIZE;
+}
+
+static inline void nl_object_invalidate_hash(struct nl_object *obj)
+{
+	obj->ce_flags &= ~NL_OBJ_HASHED;
+}
+
+/* To be called by setters before modifying out-of-line members in place */
+static inline int nl_object_unshare(struct nl_object *obj, uint32_t attrs)
+{
+	if (!(obj->ce_flags & NL_OBJ_COW) || !obj->ce_ops->oo_unshare)
+		return 0;
+
+	return obj->ce_ops->oo_unshare(obj, attrs);
+}
+
+extern struct rtnl_route_metrics *__rtnl_route_metrics_parse(struct nl_data *);
+
+/* Returns the local port bitmap slot of a socket not marked NL_OWN_PORT */
+extern void __nl_socket_release_local_port(struct nl_sock *);
+
+/* Safe to call concurrently from readers, see struct rtnl_route */
+static inline struct rtnl_route_metrics *
+rtnl_route_metrics_expand(struct rtnl_route *route)
+{
+	struct rtnl_route_metrics *m;
+
+	if (route->rt_metrics || !route->rt_metrics_raw)
+		return route->rt_metrics;
+
+	if (!(m = __rtnl_route_metrics_parse(route->rt_metrics_raw)))
+		return NULL;
+
+	if (!__sync_bool_compare_and_swap(&route->rt_metrics, NULL, m))
+		free(m);
+
+	if (!route->ce_cache) {
+		nl_data_free(route->rt_metrics_raw);
+		route->rt_metrics_raw = NULL;
+	}
+
+	return route->rt_metrics;
+}
+
+/* Used by nl_object_get() and nl_object_put(), see NLHDR_COMMON */
+static inline void nl_object_ref(struct nl_object *obj)
+{
+	__sync_fetch_and_add(&obj->ce_refcnt, 1);
+}
+
+/* Returns true if the last reference was dropped */
+static inline int nl_object_unref(struct nl_object *obj)
+{
+	return __sync_sub_and_fetch(&obj->ce_refcnt, 1) == 0;
+}
+
+static inline void nl_object_slab_get(struct nl_object_slab *slab)
+{
+	__sync_fetch_and_add(&slab->os_refcnt, 1);
+}
+
+/* Returns true if the last reference was dropped */
+static inline int nl_object_slab_put(struct nl_object_slab *slab)
+{
+	return __sync_sub_and_fetch(&slab->os_refcnt, 1) == 0;
+}
+
+static inline void rtnl_nh_set_get(struct rtnl_nh_set *set)
+{
+	__sync_fetch_and_add(&set->ns_refcnt, 1);
+}
+
+/* Returns true if the last reference was dropped */
+static inline int rtnl_nh_set_put(struct rtnl_nh_set *set)
+{
+	return __sync_sub_and_fetch(&set->ns_refcnt, 1) == 0;
+}
+
+/* Helpers for oo_mem_usage implementations */
+static inline size_t nl_addr_mem_size(struct nl_addr *addr)
+{
+	if (!addr)
+		return 0;
+
+	return (sizeof(*addr) + addr->a_maxsize) / addr->a_refcnt;
+}
+
+static inline size_t nl_data_mem_size(struct nl_data *data)
+{
+	if (!data)
+		return 0;
+
+	return (sizeof(*data) + data->d_size) / data->d_refcnt;
+}
+
+static inline int rtnl_link_fingerprint_match(struct rtnl_link *link,
+					      struct rtnl_link_fingerprint *fp)
+{
+	return link->l_flags == fp->lf_flags &&
+	       link->l_operstate == fp->lf_operstate &&
+	       link->l_mtu == fp->lf_mtu &&
+	       link->l_master == fp->lf_master &&
+	       link->l_event_hash == fp->lf_hash;
+}
+
 static inline char *nl_cache_name(struct nl_cache *cache)
 {
 	return cache->c_ops ? cache->c_ops->co_name : "unknown";
@@ -175,6 +313,26 @@ static inline char *nl_cache_name(struct nl_cache *cache)
 		END_OF_MSGTYPES_LIST, \
 	}
 
+/* Reserves n consecutive sequence numbers, returns the first one */
+static inline unsigned int nl_socket_reserve_seq(struct nl_sock *sk,
+						 unsigned int n)
+{
+	unsigned int seq;
+
+	if (sk->s_flags & NL_SOCK_SHARED)
+		return __sync_fetch_and_add(&sk->s_seq_next, n);
+
+	seq = sk->s_seq_next;
+	sk->s_seq_next += n;
+
+	return seq;
+}
+
+static inline unsigned int nl_socket_next_seq(struct nl_sock *sk)
+{
+	return nl_socket_reserve_seq(sk, 1);
+}
+
 static inline int wait_for_ack(struct nl_sock *sk)
 {
 	if (sk->s_flags & NL_NO_AUTO_ACK)
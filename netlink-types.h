@@ -17,8 +17,10 @@
 #include <netlink/route/qdisc.h>
 #include <netlink/route/rtnl.h>
 #include <netlink/route/route.h>
+#include <netlink/route/neightbl.h>
 #include <netlink/object-api.h>
 #include <linux/socket.h>
+#include <pthread.h>
 #include <linux/pkt_sched.h>
 
 #define NL_SOCK_BUFSIZE_SET	(1<<0)
@@ -26,6 +28,11 @@
 #define NL_OWN_PORT		(1<<2)
 #define NL_MSG_PEEK		(1<<3)
 #define NL_NO_AUTO_ACK		(1<<4)
+#define NL_SOCK_BUFSIZE_ADAPTIVE (1<<5)
+#define NL_SOCK_BUFSIZE_FORCE	(1<<6)
+#define NL_SOCK_EXT_ACK		(1<<7)
+#define NL_SOCK_CAP_ACK		(1<<8)
+#define NL_SOCK_SHARED		(1<<9)
 
 #define NL_MSG_CRED_PRESENT 1
 
@@ -41,6 +48,10 @@ struct nl_cb
 	nl_recvmsg_err_cb_t	cb_err;
 	void *			cb_err_arg;
 
+	/** Takes precedence over cb_err if set */
+	nl_recvmsg_err_ext_cb_t	cb_err_ext;
+	void *			cb_err_ext_arg;
+
 	/** May be used to replace nl_recvmsgs with your own implementation
 	 * in all internal calls to nl_recvmsgs. */
 	int			(*cb_recvmsgs_ow)(struct nl_sock *,
@@ -61,6 +72,37 @@ struct nl_cb
 	int			cb_refcnt;
 };
 
+#define NL_SEQ_WAITER_HASH_SIZE	64
+
+/*
+ * A request in flight on a shared socket. The receiving thread looks
+ * up the waiter by sequence number, runs the message through sw_cb and
+ * wakes up the sender once the ACK, error or end of dump arrived.
+ *
+ * NLM_F_DUMP_INTR is tracked per request, never per socket, as several
+ * dumps may run at once on a shared socket: sw_dump_intr is cleared
+ * when the request is sent and set by the receiving thread for this
+ * sequence number only. The cache code on private sockets keeps the
+ * flag in its own per-dump state the same way (the pickup parameters
+ * of nl_cache_pickup(), NL_REFILL_INTR of struct nl_refill).
+ */
+struct nl_seq_waiter
+{
+	unsigned int		sw_seq;
+	struct nl_cb *		sw_cb;
+	int			sw_done;
+	int			sw_error;
+	int			sw_dump_intr;
+	pthread_cond_t		sw_cond;
+	struct nl_seq_waiter *	sw_next;
+};
+
+struct nl_seq_table
+{
+	pthread_mutex_t		st_lock;
+	struct nl_seq_waiter *	st_hash[NL_SEQ_WAITER_HASH_SIZE];
+};
+
 struct nl_sock
 {
 	struct sockaddr_nl	s_local;
@@ -71,6 +113,44 @@ struct nl_sock
 	unsigned int		s_seq_expect;
 	int			s_flags;
 	struct nl_cb *		s_cb;
+
+	/* Adaptive receive buffer state, see nl_socket_set_buffer_adaptive().
+	 * The buffer grows on overrun or when the queue occupancy reaches
+	 * 3/4 of it and shrinks after s_buf_idle reads below 1/4. */
+	struct nl_sock_bufstats	s_bufstats;
+	int			s_buf_idle;
+
+	/* Only allocated for sockets marked NL_SOCK_SHARED, s_seq_next
+	 * is then advanced atomically. */
+	struct nl_seq_table *	s_waiters;
+};
+
+/*
+ * Pool of connected sockets of one protocol. nl_sock_pool_put() parks a
+ * socket in the calling thread's slot (sp_affinity) so the next get from
+ * the same thread returns it without locking; the slot's previous
+ * occupant, if any, goes back to the shared free list. Sockets are
+ * bound with nl_pid 0 so the kernel assigns the port. nl_socket_alloc()
+ * has already taken a slot of the library's local port bitmap, the pool
+ * returns it with __nl_socket_release_local_port() before clearing
+ * nl_pid and setting NL_OWN_PORT, so that pooled sockets do not leak
+ * any of the process-wide slots. They are run through sp_setup once after
+ * nl_connect(). Every socket handed out is also linked into sp_all, so
+ * that nl_sock_pool_free() can release sockets parked in other threads'
+ * slots, pthread_key_delete() does not run destructors for those.
+ */
+struct nl_sock_pool
+{
+	int			sp_protocol;
+	int			sp_size;
+	int			sp_nfree;
+	int			sp_nalloc;
+	struct nl_sock **	sp_free;
+	struct nl_sock **	sp_all;
+	pthread_mutex_t		sp_lock;
+	pthread_key_t		sp_affinity;
+	int		      (*sp_setup)(struct nl_sock *, void *);
+	void *			sp_setup_arg;
 };
 
 struct nl_cache
@@ -80,6 +160,67 @@ struct nl_cache
 	int                     c_iarg1;
 	int                     c_iarg2;
 	struct nl_cache_ops *   c_ops;
+	unsigned int		c_flags;
+	struct nl_object_pool *	c_pool;		/* NL_CACHE_POOLED only */
+	struct nl_list_head	c_reclaim;	/* nl_reclaim_queue entry */
+
+	/* Held for reading by nl_cache_read_lock() and for writing by
+	 * every path modifying c_items: nl_cache_add(), nl_cache_remove(),
+	 * nl_cache_include(), nl_cache_clear(), nl_cache_refill() and the
+	 * shadow swap of nl_refill_commit(). Object references taken
+	 * by readers are safe as ce_refcnt is updated atomically. */
+	pthread_rwlock_t	c_lock;
+
+	/* NLM_F_DUMP_INTR handling, see nl_cache_set_dump_intr_policy().
+	 * A zeroed cache accepts inconsistent dumps like before and only
+	 * flags itself for resync. */
+	int			c_intr_policy;
+	int			c_intr_max_retries;
+	int			c_intr_backoff;		/* msecs, doubled per retry */
+	int			c_needs_resync;
+	struct nl_cache_dump_stats c_dump_stats;
+};
+
+#define NL_REFILL_REQUESTED	(1<<0)
+#define NL_REFILL_DONE		(1<<1)
+#define NL_REFILL_INTR		(1<<2)	/* cleared when the dump is requested */
+#define NL_REFILL_SHADOW	(1<<3)
+#define NL_REFILL_FAILED	(1<<4)
+
+/*
+ * State of a resumable refill. Each nl_refill_step() receives from
+ * the (non-blocking) socket until at least rf_chunk objects have been
+ * added or no more data is pending.
+ *
+ * A dump flagged NLM_F_DUMP_INTR is handled according to the cache's
+ * c_intr_policy like in nl_cache_refill(). NL_DUMP_INTR_ACCEPT keeps
+ * the result and marks the cache for resync. NL_DUMP_INTR_RETRY clears
+ * the partial contents and requests the dump again once rf_resume has
+ * passed, the backoff starting at c_intr_backoff and doubling per
+ * restart; nl_refill_step() never sleeps. After c_intr_max_retries
+ * restarts the refill is marked NL_REFILL_FAILED and every further
+ * step returns -NLE_DUMP_INTR.
+ *
+ * In shadow mode (NL_REFILL_SHADOW) objects are added to rf_shadow
+ * instead, rf_cache stays untouched until nl_refill_commit() computes
+ * the changes and swaps the contents under c_lock. The ce_cache
+ * back-pointers of the new objects are redirected to rf_cache while
+ * holding the write lock, before the lists are exchanged; the old
+ * objects are unlinked with ce_cache reset to NULL and put only after
+ * the lock was dropped, and the emptied shadow is freed last.
+ */
+struct nl_refill
+{
+	struct nl_sock *	rf_sock;
+	struct nl_cache *	rf_cache;
+	struct nl_cache *	rf_shadow;
+	struct nl_cb *		rf_cb;
+	int			rf_chunk;
+	int			rf_count;
+	int			rf_total;
+	int			rf_restarts;
+	int			rf_flags;
+	struct timespec		rf_resume;	/* CLOCK_MONOTONIC */
 };
 
 struct nl_cache_assoc
@@ -89,6 +230,17 @@ struct nl_cache_assoc
 	void *			ca_change_data;
 };
 
+/*
+ * Set of provided caches, indexed by the co_id of the cache ops.
+ * nl_cache_mngt_require() consults the provider of the calling thread
+ * first and falls back to the global co_major_cache.
+ */
+struct nl_cache_provider
+{
+	struct nl_cache **	pv_caches;
+	int			pv_size;
+};
+
 struct nl_cache_mngr
 {
 	int			cm_protocol;
@@ -96,6 +248,58 @@ struct nl_cache_mngr
 	int			cm_nassocs;
 	struct nl_sock *	cm_handle;
 	struct nl_cache_assoc *	cm_assocs;
+	/* NL_AUTO_PROVIDE_SCOPED only, NL_AUTO_PROVIDE keeps publishing
+	 * to the global co_major_cache slot */
+	struct nl_cache_provider *cm_provider;
+};
+
+/*
+ * Receive buffer space accounted per queued ACK. The kernel charges
+ * the truesize of the skb, which is far larger than the message.
+ */
+#define NL_BATCH_ACK_COST	1024
+
+/**
+ * Pipelined request batch
+ *
+ * Messages are sent with NLM_F_ACK set and consecutive sequence
+ * numbers starting at b_seq_first, the acknowledgements are matched
+ * to b_errors[] by sequence number. The range is reserved in one step
+ * with nl_socket_reserve_seq() so that other threads sending on a
+ * shared socket cannot interleave sequence numbers.
+ *
+ * The kernel queues ACKs with MSG_DONTWAIT, an ACK which does not fit
+ * into SO_RCVBUF is dropped and the socket reports ENOBUFS. At most
+ * b_window requests are therefore in flight: once the window is full,
+ * pending ACKs are drained before the next message is sent. The window
+ * defaults to SO_RCVBUF / NL_BATCH_ACK_COST when the batch is sent,
+ * see nl_batch_set_window().
+ */
+struct nl_batch
+{
+	struct nl_sock *	b_sock;
+	struct nl_msg **	b_msgs;
+	int *			b_errors;
+	int			b_nmsgs;
+	int			b_size;
+	int			b_window;	/* 0: derive from SO_RCVBUF */
+	unsigned int		b_seq_first;
+};
+
+#define NL_CACHE_OPS_HASH_SIZE	64
+#define NL_MSGTYPE_HASH_SIZE	256
+
+/*
+ * Entry of the (protocol, msgtype) hash table of the cache ops registry,
+ * one per co_msgtypes[] entry of each registered cache ops.
+ */
+struct nl_msgtype_assoc
+{
+	int			ma_protocol;
+	int			ma_msgtype;
+	struct nl_cache_ops *	ma_ops;
+	struct nl_msgtype *	ma_mt;
+	struct nl_msgtype_assoc *ma_next;
 };
 
 struct nl_parser_param;
@@ -103,16 +307,156 @@ struct nl_parser_param;
 #define LOOSE_COMPARISON	1
 
 #define NL_OBJ_MARK		1
+#define NL_OBJ_HASHED		2	/* ce_hash is valid */
+#define NL_OBJ_COW		4	/* out-of-line members may be shared */
+#define NL_OBJ_POOLED		8	/* allocated from an nl_object_slab */
 
 struct nl_object
 {
 	NLHDR_COMMON
 };
 
+/* Objects in a slab are aligned for the uint64_t members of NLHDR_COMMON */
+#define NL_OBJ_SLAB_ALIGN	__alignof__(uint64_t)
+#define NL_OBJ_SLAB_STRIDE(size) \
+	(((size) + NL_OBJ_SLAB_ALIGN - 1) & ~(NL_OBJ_SLAB_ALIGN - 1))
+
+/*
+ * Object slabs of a pooled cache. Objects allocated while the cache is
+ * being filled are carved out of slabs of os_nobjs objects each. When
+ * the cache is freed, objects only referenced by the cache release
+ * their members and the slabs are dropped as a whole; objects still
+ * referenced elsewhere keep their slab alive through os_refcnt.
+ */
+struct nl_object_slab
+{
+	struct nl_object_pool *	os_pool;
+	/* Dropped by the reclaim thread and by threads putting objects
+	 * they kept, only modified through __sync atomics */
+	int			os_refcnt;
+	int			os_nobjs;
+	int			os_used;
+	struct nl_list_head	os_list;
+	char			os_data[0] __attribute__((aligned(8)));
+};
+
+struct nl_object_pool
+{
+	struct nl_object_ops *	op_ops;
+	size_t			op_stride;	/* NL_OBJ_SLAB_STRIDE(oo_size) */
+	int			op_slab_nobjs;
+	int			op_nslabs;
+	struct nl_list_head	op_slabs;
+};
+
+/*
+ * Caches queued by nl_cache_free_deferred() for the reclaim thread.
+ * Objects still referenced elsewhere and objects marked NL_OBJ_COW are
+ * released synchronously before queueing. The remaining objects may
+ * still share out-of-line members (addresses held with nl_addr_get(),
+ * data blobs, nexthop sets of copy-on-write clones) with objects in use
+ * by other threads; a_refcnt, d_refcnt and ns_refcnt are therefore only
+ * modified through __sync atomics.
+ */
+struct nl_reclaim_queue
+{
+	pthread_mutex_t		rq_lock;
+	pthread_cond_t		rq_cond;
+	pthread_t		rq_thread;
+	int			rq_running;
+	int			rq_pending;
+	struct nl_list_head	rq_caches;	/* via c_reclaim */
+};
+
+/*
+ * Compact filter: a sparse list of attribute/value pairs. The filter
+ * takes the object ops of the cache it was allocated for, the setters
+ * select attributes by oa_name since the attribute bits are private to
+ * the library; a name not found in oo_attrs, or a value not matching
+ * its oa_type, is rejected with -NLE_INVAL. The terms are resolved
+ * into (type, offset) pairs when the filter is first used and ordered
+ * so that integer terms are checked before address and string terms.
+ * Filters built by nl_object_filter_from_object() may carry attributes
+ * not described by oo_attrs, those fall back to a full example object
+ * and oo_compare().
+ */
+struct nl_filter_term
+{
+	uint32_t		ft_id;
+	int			ft_type;
+	size_t			ft_offset;
+	union {
+		uint64_t	u;
+		struct nl_addr *addr;
+		char *		str;
+	}			ft_val;
+};
+
+/* of_terms is grown with realloc() one term at a time */
+struct nl_object_filter
+{
+	struct nl_object_ops *	of_ops;
+	uint32_t		of_mask;
+	int			of_nterms;
+	int			of_compiled;
+	struct nl_object *	of_fallback;
+	struct nl_filter_term *	of_terms;
+};
+
+enum {
+	NL_EXPR_OP_EQ,
+	NL_EXPR_OP_NE,
+	NL_EXPR_OP_LT,
+	NL_EXPR_OP_LE,
+	NL_EXPR_OP_GT,
+	NL_EXPR_OP_GE,
+	NL_EXPR_OP_PREFIX,	/* address within ei_val.addr */
+	NL_EXPR_OP_AND,
+	NL_EXPR_OP_OR,
+	NL_EXPR_OP_NOT,
+};
+
+/*
+ * Expression bytecode in postfix order, evaluated on a bit stack.
+ * Comparisons push one bit, AND/OR/NOT combine the topmost bits.
+ */
+struct nl_expr_insn
+{
+	uint8_t			ei_op;
+	uint8_t			ei_type;	/* NL_OBJ_ATTR_* */
+	uint32_t		ei_id;
+	size_t			ei_offset;
+	union {
+		uint64_t	u;
+		struct nl_addr *addr;
+		char *		str;
+	}			ei_val;
+};
+
+struct nl_expr
+{
+	struct nl_object_ops *	ex_ops;
+	int			ex_ninsns;
+	int			ex_depth;	/* max stack depth */
+	/* Attributes the whole expression requires to equal a
+	 * constant, used by callers with secondary indexes */
+	uint32_t		ex_key_mask;
+	struct nl_expr_insn	ex_insns[0];
+};
+
+/* Columns are sized for c_nitems rows up front and filled in one pass */
+struct nl_column_set
+{
+	size_t			cs_nrows;
+	int			cs_ncolumns;
+	struct nl_column *	cs_columns;
+};
+
 struct nl_data
 {
 	size_t			d_size;
 	void *			d_data;
+	int			d_refcnt;	/* __sync atomics only */
 };
 
 struct nl_addr
@@ -121,7 +465,7 @@ struct nl_addr
 	unsigned int		a_maxsize;
 	unsigned int		a_len;
 	int			a_prefixlen;
-	int			a_refcnt;
+	int			a_refcnt;	/* __sync atomics only */
 	char			a_addr[0];
 };
 
@@ -176,6 +520,83 @@ struct rtnl_link
 	/* 2 byte hole */
 	struct rtnl_link_info_ops *l_info_ops;
 	void *		l_info;
+	uint64_t	l_event_hash;	/* lf_hash of the last parsed message */
+};
+
+/*
+ * Compact summary of a link used by the event fast path, extracted
+ * from the ifinfomsg header and the IFLA_MTU, IFLA_MASTER and
+ * IFLA_OPERSTATE attributes without parsing the full message.
+ * lf_hash covers the raw payload of every other attribute except
+ * IFLA_STATS and IFLA_STATS64, so renames, address, txqlen, qdisc and
+ * linkinfo changes still cause a full parse.
+ */
+struct rtnl_link_fingerprint
+{
+	uint32_t	lf_index;
+	uint32_t	lf_flags;
+	uint32_t	lf_mtu;
+	uint32_t	lf_master;
+	uint8_t		lf_operstate;
+	uint64_t	lf_hash;
+};
+
+/*
+ * Typed IFLA_INFO_DATA of the built-in link info operations,
+ * stored in rtnl_link->l_info.
+ */
+struct rtnl_link_vlan
+{
+	uint16_t	lv_id;
+	uint16_t	lv_protocol;
+	uint32_t	lv_flags;
+	uint32_t	lv_flags_mask;
+	uint32_t	lv_mask;
+};
+
+struct rtnl_link_vxlan
+{
+	uint32_t	lx_id;
+	uint32_t	lx_link;
+	struct nl_addr *lx_group;
+	struct nl_addr *lx_local;
+	uint16_t	lx_port;
+	uint8_t		lx_ttl;
+	uint8_t		lx_tos;
+	uint32_t	lx_mask;
+};
+
+struct rtnl_link_bond
+{
+	uint8_t		lb_mode;
+	/* 3 byte hole */
+	uint32_t	lb_miimon;
+	uint32_t	lb_active_slave;
+	uint32_t	lb_mask;
+};
+
+struct rtnl_link_bridge
+{
+	uint32_t	lbr_forward_delay;
+	uint32_t	lbr_hello_time;
+	uint32_t	lbr_max_age;
+	uint32_t	lbr_ageing_time;
+	uint32_t	lbr_stp_state;
+	uint16_t	lbr_priority;
+	/* 2 byte hole */
+	uint32_t	lbr_mask;
+};
+
+/*
+ * veth has no fill_info, dumps carry no IFLA_INFO_DATA and the peer
+ * ifindex arrives in IFLA_LINK (l_link). Only used when creating a
+ * pair: the peer is sent as nested VETH_INFO_PEER ifinfomsg carrying
+ * IFLA_IFNAME.
+ */
+struct rtnl_link_veth
+{
+	char		lve_peer_name[IFNAMSIZ];
+	uint32_t	lve_mask;
 };
 
 struct rtnl_ncacheinfo
@@ -241,6 +662,25 @@ struct rtnl_addr
 	uint32_t a_flag_mask;
 };
 
+struct rtnl_addr_reconcile
+{
+	struct nl_cache *	rc_cache;
+
+	/* Desired addresses, references held */
+	struct rtnl_addr **	rc_desired;
+	int			rc_ndesired;
+	int			rc_desired_size;
+
+	/* Interfaces whose address set is managed */
+	uint32_t *		rc_links;
+	int			rc_nlinks;
+	int			rc_links_size;
+
+	/* Outcome of the last commit */
+	struct rtnl_addr_result *rc_results;
+	int			rc_nresults;
+};
+
 struct rtnl_nexthop
 {
 	uint8_t			rtnh_flags;
@@ -254,6 +694,42 @@ struct rtnl_nexthop
 	uint32_t		rtnh_realms;
 };
 
+/*
+ * Nexthop list of a route, allocated with the first nexthop and shared
+ * with copy-on-write clones. nl_object_clone_cow() only takes another
+ * reference, the source route is not modified otherwise and may be
+ * cloned by readers holding nl_cache_read_lock(). ns_refcnt is only
+ * modified through __sync atomics, see rtnl_nh_set_get().
+ *
+ * rtnl_route_add_nexthop() and rtnl_route_remove_nexthop() give the
+ * route a private copy of the list first if ns_refcnt is above 1, on
+ * the source as well as on the clone. All getters, including
+ * get_nexthops, foreach_nexthop and nexthop_n, read through the set
+ * without copying; callers about to modify a nexthop they obtained
+ * that way call rtnl_route_unshare_nexthops() first.
+ */
+struct rtnl_nh_set
+{
+	int			ns_refcnt;
+	struct nl_list_head	ns_list;
+};
+
+struct rtnl_route_metric
+{
+	uint16_t		rmv_id;
+	/* 2 byte hole */
+	uint32_t		rmv_value;
+};
+
+/* Sorted by rmv_id, rms_mask has bit (id - 1) set for each entry */
+struct rtnl_route_metrics
+{
+	uint32_t		rms_mask;
+	uint8_t			rms_n;
+	uint8_t			rms_size;
+	struct rtnl_route_metric rms_v[0];
+};
+
 struct rtnl_route
 {
 	NLHDR_COMMON
@@ -265,22 +741,53 @@ struct rtnl_route
 	uint8_t			rt_protocol;
 	uint8_t			rt_scope;
 	uint8_t			rt_type;
-	uint8_t			rt_nmetrics;
+	/* 1 byte hole */
 	uint32_t		rt_flags;
 	struct nl_addr *	rt_dst;
 	struct nl_addr *	rt_src;
 	uint32_t		rt_table;
 	uint32_t		rt_iif;
 	uint32_t		rt_prio;
-	uint32_t		rt_metrics[RTAX_MAX];
-	uint32_t		rt_metrics_mask;
+	/* Metrics are kept out of line and only for routes which carry
+	 * any; the number of metrics is rt_metrics->rms_n. RTA_METRICS
+	 * is stored unparsed in rt_metrics_raw and expanded on first
+	 * access by rtnl_route_metrics_expand(). Readers may run
+	 * concurrently under nl_cache_read_lock(), therefore the expanded
+	 * vector is built privately and published with a compare-and-swap
+	 * on rt_metrics; a reader losing the race frees its copy.
+	 * Once published, rt_metrics_raw is released by the expanding
+	 * thread if the route is not in a cache (ce_cache is NULL).
+	 * Cached routes keep it until they are freed: other readers under
+	 * the read lock may still be parsing it, and no reference can be
+	 * taken on it race-free from the read side. */
+	struct rtnl_route_metrics *rt_metrics;
+	struct nl_data *	rt_metrics_raw;
 	uint32_t		rt_nr_nh;
 	struct nl_addr *	rt_pref_src;
-	struct nl_list_head	rt_nexthops;
+	struct rtnl_nh_set *	rt_nh_set;	/* NULL without nexthops */
 	struct rtnl_rtcacheinfo	rt_cacheinfo;
 	uint32_t		rt_flag_mask;
 };
 
+#define RTNL_ROUTE_TABLES_HASH_SIZE	1024
+
+/* One partition per (family, table), each with its own route cache */
+struct rtnl_route_table_part
+{
+	int			rp_family;
+	uint32_t		rp_table;
+	struct nl_cache *	rp_cache;
+	struct rtnl_route_table_part *rp_next;
+};
+
+struct rtnl_route_tables
+{
+	int			rts_family;
+	int			rts_flags;
+	int			rts_nparts;
+	struct rtnl_route_table_part *rts_hash[RTNL_ROUTE_TABLES_HASH_SIZE];
+};
+
 struct rtnl_rule
 {
 	NLHDR_COMMON
@@ -300,6 +807,13 @@ struct rtnl_rule
 	struct nl_addr *r_srcmap;
 };
 
+/* Rules sorted by (r_family, r_prio), references held */
+struct rtnl_rule_index
+{
+	struct rtnl_rule **	ri_rules;
+	int			ri_nrules;
+};
+
 struct rtnl_neightbl_parms
 {
 	/**
@@ -393,8 +907,6 @@ struct rtnl_neightbl_parms
 	uint32_t		ntp_mask;
 };
 
-#define NTBLNAMSIZ	32
-
 /**
  * Neighbour table
  * @ingroup neightbl
@@ -414,6 +926,34 @@ struct rtnl_neightbl
 	struct ndt_stats	nt_stats;
 };
 
+/**
+ * Previous sample of a neighbour table. Only the per-table message
+ * carries NDTA_STATS and the entry count, objects of device parameter
+ * sets (no NEIGHTBL_ATTR_STATS) are skipped by the sampler.
+ *
+ * ns_stamp is taken from CLOCK_MONOTONIC so that clock steps cannot
+ * produce negative or huge intervals. If any counter went backwards,
+ * the table was recreated: the sample is reset to the new statistics
+ * and no rates are emitted for that interval.
+ */
+struct rtnl_neightbl_sample
+{
+	char			ns_name[NTBLNAMSIZ];
+	uint32_t		ns_family;
+	struct timespec		ns_stamp;
+	struct ndt_stats	ns_stats;
+	struct rtnl_neightbl_rates ns_rates;
+	struct nl_list_head	ns_list;
+};
+
+struct rtnl_neightbl_sampler
+{
+	/* hash_grows per second considered a storm */
+	double			ts_storm_rate;
+	int			ts_nsamples;
+	struct nl_list_head	ts_samples;
+};
+
 struct rtnl_ratespec
 {
 	uint8_t			rs_cell_log;
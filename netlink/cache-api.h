@@ -182,10 +182,25 @@ struct nl_cache_ops
 	int   (*co_msg_parser)(struct nl_cache_ops *, struct sockaddr_nl *,
 			       struct nlmsghdr *, struct nl_parser_param *);
 
+	/**
+	 * Called for every notification before it is parsed. May compare
+	 * a cheap summary of the message against the cached object and
+	 * return NL_SKIP if the full parse and inclusion can be avoided,
+	 * NL_OK to have the message parsed and included as usual.
+	 * Optional.
+	 */
+	int   (*co_event_filter)(struct nl_cache *, struct nlmsghdr *);
+
 	struct nl_object_ops *	co_obj_ops;
 
 	struct nl_cache_ops *co_next;
 	struct nl_cache *co_major_cache;
+
+	/* Registry index assigned by nl_cache_mngt_register() */
+	int			co_id;
+	/* Chain in the name hash table of the registry */
+	struct nl_cache_ops *	co_hash_next;
+
 	struct genl_ops *	co_genl;
 	struct nl_msgtype	co_msgtypes[];
 };
@@ -24,6 +24,10 @@ extern "C" {
 
 struct nl_cache;
 
+/* Cache flags, the upper 16 bits are reserved for the cache type */
+#define NL_CACHE_POOLED		(1<<0)	/* allocate objects from slabs */
+#define NL_CACHE_TYPE_FLAGS	0xffff0000
+
 typedef void (*change_func_t)(struct nl_cache *, struct nl_object *, int, void *);
 
 /* Access Functions */
@@ -44,8 +48,15 @@ extern int			nl_cache_alloc_name(const char *,
 						    struct nl_cache **);
 extern struct nl_cache *	nl_cache_subset(struct nl_cache *,
 						struct nl_object *);
+extern struct nl_cache *	nl_cache_subset_match(struct nl_cache *,
+						      struct nl_object_filter *);
 extern void			nl_cache_clear(struct nl_cache *);
+extern void			nl_cache_set_flags(struct nl_cache *,
+						   unsigned int);
+extern unsigned int		nl_cache_get_flags(struct nl_cache *);
 extern void			nl_cache_free(struct nl_cache *);
+extern void			nl_cache_free_deferred(struct nl_cache *);
+extern void			nl_cache_reclaim_flush(void);
 
 /* Cache modification */
 extern int			nl_cache_add(struct nl_cache *,
@@ -66,10 +77,74 @@ extern int			nl_cache_include(struct nl_cache *,
 						 change_func_t,
 						 void *);
 
+/* Dump consistency */
+#define NL_DUMP_INTR_ACCEPT	0	/* keep result, mark for resync (default) */
+#define NL_DUMP_INTR_RETRY	1	/* retry the dump with backoff */
+
+/**
+ * Dump consistency counters of a cache
+ * @ingroup cache
+ */
+struct nl_cache_dump_stats
+{
+	uint64_t	ds_dumps;	/**< Dumps completed */
+	uint64_t	ds_intr;	/**< Dumps flagged NLM_F_DUMP_INTR */
+	uint64_t	ds_retries;	/**< Dumps repeated */
+	uint64_t	ds_accepted;	/**< Inconsistent dumps accepted */
+	uint64_t	ds_failed;	/**< Refills failed after max retries */
+};
+
+extern void			nl_cache_set_dump_intr_policy(struct nl_cache *,
+							      int, int, int);
+extern int			nl_cache_needs_resync(struct nl_cache *);
+extern void			nl_cache_get_dump_stats(struct nl_cache *,
+							struct nl_cache_dump_stats *);
+
+/* Resumable refill */
+struct nl_refill;
+
+extern int			nl_refill_alloc(struct nl_sock *,
+						struct nl_cache *, int,
+						struct nl_refill **);
+extern void			nl_refill_free(struct nl_refill *);
+extern int			nl_refill_step(struct nl_refill *);
+extern int			nl_refill_done(struct nl_refill *);
+extern int			nl_refill_restarts(struct nl_refill *);
+
+/* Double buffered refresh */
+extern int			nl_cache_refresh(struct nl_sock *,
+						 struct nl_cache *,
+						 change_func_t, void *);
+extern int			nl_refill_alloc_shadow(struct nl_sock *,
+						       struct nl_cache *, int,
+						       struct nl_refill **);
+extern int			nl_refill_commit(struct nl_refill *,
+						 change_func_t, void *);
+
+/* Reader locking */
+extern void			nl_cache_read_lock(struct nl_cache *);
+extern void			nl_cache_read_unlock(struct nl_cache *);
+
 /* General */
 extern int			nl_cache_is_empty(struct nl_cache *);
 extern void			nl_cache_mark_all(struct nl_cache *);
 
+/**
+ * Memory report of a cache
+ * @ingroup cache
+ */
+struct nl_cache_mem_report
+{
+	int			mr_nobjs;	/**< Number of objects */
+	size_t			mr_cache;	/**< Cache structure itself */
+	struct nl_mem_usage	mr_objs;	/**< Sum over all objects */
+};
+
+extern void			nl_cache_mem_report(struct nl_cache *,
+						    struct nl_cache_mem_report *);
+extern void			nl_cache_mem_report_dump(struct nl_cache *,
+							 struct nl_dump_params *);
+
 /* Dumping */
 extern void			nl_cache_dump(struct nl_cache *,
 					      struct nl_dump_params *);
@@ -88,12 +163,20 @@ extern void			nl_cache_foreach_filter(struct nl_cache *,
 								   nl_object *,
 								   void *),
 							void *arg);
+extern void			nl_cache_foreach_match(struct nl_cache *,
+						       struct nl_object_filter *,
+						       void (*cb)(struct
+								  nl_object *,
+								  void *),
+						       void *arg);
 
 /* --- cache management --- */
 
 /* Cache type management */
 extern struct nl_cache_ops *	nl_cache_ops_lookup(const char *);
 extern struct nl_cache_ops *	nl_cache_ops_associate(int, int);
+extern struct nl_cache_ops *	nl_cache_ops_associate_msgtype(int, int,
+						struct nl_msgtype **);
 extern struct nl_msgtype *	nl_msgtype_lookup(struct nl_cache_ops *, int);
 extern void			nl_cache_ops_foreach(void (*cb)(struct nl_cache_ops *, void *), void *);
 extern int			nl_cache_mngt_register(struct nl_cache_ops *);
@@ -104,9 +187,24 @@ extern void			nl_cache_mngt_provide(struct nl_cache *);
 extern void			nl_cache_mngt_unprovide(struct nl_cache *);
 extern struct nl_cache *	nl_cache_mngt_require(const char *);
 
+/* Scoped cache provisioning */
+struct nl_cache_provider;
+
+extern struct nl_cache_provider *nl_cache_provider_alloc(void);
+extern void			nl_cache_provider_free(struct nl_cache_provider *);
+extern int			nl_cache_provider_add(struct nl_cache_provider *,
+						      struct nl_cache *);
+extern void			nl_cache_provider_remove(struct nl_cache_provider *,
+							 struct nl_cache *);
+extern struct nl_cache *	nl_cache_provider_lookup(struct nl_cache_provider *,
+							 const char *);
+extern struct nl_cache_provider *nl_cache_provider_set_current(struct nl_cache_provider *);
+extern struct nl_cache_provider *nl_cache_provider_get_current(void);
+
 struct nl_cache_mngr;
 
 #define NL_AUTO_PROVIDE		1
+#define NL_AUTO_PROVIDE_SCOPED	2
 
 extern int			nl_cache_mngr_alloc(struct nl_sock *,
 						    int, int,
@@ -120,6 +218,7 @@ extern int			nl_cache_mngr_get_fd(struct nl_cache_mngr *);
 extern int			nl_cache_mngr_poll(struct nl_cache_mngr *,
 						   int);
 extern int			nl_cache_mngr_data_ready(struct nl_cache_mngr *);
+extern struct nl_cache_provider *nl_cache_mngr_get_provider(struct nl_cache_mngr *);
 extern void			nl_cache_mngr_free(struct nl_cache_mngr *);
 
 #ifdef __cplusplus
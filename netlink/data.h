@@ -27,6 +27,10 @@ extern struct nl_data *	nl_data_clone(struct nl_data *);
 extern int		nl_data_append(struct nl_data *, void *, size_t);
 extern void		nl_data_free(struct nl_data *);
 
+/* Usage Management */
+extern struct nl_data *	nl_data_hold(struct nl_data *);
+extern int		nl_data_shared(struct nl_data *);
+
 /* Access Functions */
 extern void *		nl_data_get(struct nl_data *);
 extern size_t		nl_data_get_size(struct nl_data *);
@@ -46,8 +46,10 @@ extern "C" {
 #define NLE_NOACCESS		27
 #define NLE_PERM		28
 #define NLE_PKTLOC_FILE		29
+/* 30-32 are NLE_PARSE_ERR, NLE_NODEV and NLE_IMMUTABLE upstream */
+#define NLE_DUMP_INTR		33
 
-#define NLE_MAX			NLE_PKTLOC_FILE
+#define NLE_MAX			NLE_DUMP_INTR
 
 extern const char *	nl_geterror(int);
 extern void		nl_perror(int, const char *);
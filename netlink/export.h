@@ -0,0 +1,90 @@
+/*
+ * netlink/export.h	Columnar Cache Export
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation version 2.1
+ *	of the License.
+ */
+
+#ifndef NETLINK_EXPORT_H_
+#define NETLINK_EXPORT_H_
+
+#include <netlink/netlink.h>
+#include <netlink/cache.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Export Formats
+ * @{
+ */
+
+/** One file per column plus validity bitmap, named after the column */
+#define NL_EXPORT_RAW		0
+
+/** Single Arrow IPC file */
+#define NL_EXPORT_ARROW		1
+
+/** @} */
+
+/** Width of an address column value */
+#define NL_EXPORT_ADDR_WIDTH	(32 + 3)
+
+/**
+ * Fixed-width column of a cache snapshot
+ * @ingroup cache
+ *
+ * Integers are stored in host byte order with their natural width.
+ * Addresses of any family, including link layer addresses such as
+ * lladdr, are stored in NL_EXPORT_ADDR_WIDTH bytes: the binary address
+ * left aligned and zero padded to 32 bytes (MAX_ADDR_LEN), followed by
+ * one byte each for the address family, the address length and the
+ * prefix length. Strings are stored zero padded with the size of the
+ * object member.
+ */
+struct nl_column
+{
+	/** Name of attribute (oa_name) */
+	const char *	col_name;
+
+	/** Attribute bit */
+	uint32_t	col_id;
+
+	/** Attribute type (NL_OBJ_ATTR_*) */
+	int		col_type;
+
+	/** Width of one value in bytes */
+	size_t		col_width;
+
+	/** Number of rows */
+	size_t		col_nrows;
+
+	/** col_nrows * col_width bytes of values */
+	void *		col_data;
+
+	/** Validity bitmap, bit set if the attribute is present in the
+	 * object's ce_mask (Arrow semantics, least significant bit first) */
+	uint8_t *	col_valid;
+};
+
+struct nl_column_set;
+
+/* Columns are selected by oa_name, unknown names fail with -NLE_INVAL */
+extern int		nl_cache_export_columns(struct nl_cache *,
+						const char **, int,
+						struct nl_column_set **);
+extern int		nl_column_set_ncolumns(struct nl_column_set *);
+extern size_t		nl_column_set_nrows(struct nl_column_set *);
+extern struct nl_column *nl_column_set_get(struct nl_column_set *, int);
+extern int		nl_column_set_write(struct nl_column_set *,
+					    const char *, int);
+extern void		nl_column_set_free(struct nl_column_set *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * netlink/expr.h	Filter Expressions
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation version 2.1
+ *	of the License.
+ */
+
+#ifndef NETLINK_EXPR_H_
+#define NETLINK_EXPR_H_
+
+#include <netlink/netlink.h>
+#include <netlink/object.h>
+#include <netlink/cache.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup object
+ * @defgroup expr Filter Expressions
+ * @brief
+ *
+ * Expressions are predicates over the attributes described in the
+ * oo_attrs table of an object type, compiled into a flat bytecode.
+ *
+ * @code
+ * expr    := term { "or" term }
+ * term    := factor { "and" factor }
+ * factor  := "not" factor | "(" expr ")" | cmp
+ * cmp     := NAME OP VALUE | NAME "in" PREFIX
+ * OP      := "==" | "!=" | "<" | "<=" | ">" | ">="
+ * @endcode
+ *
+ * A comparison against an attribute which is not present in the
+ * object (see ce_mask) is false.
+ *
+ * @code
+ * // Routes of table 100 towards 10.0.0.0/8 with a priority above 10
+ * err = nl_expr_compile(route_cache,
+ * 			 "table == 100 and dst in 10.0.0.0/8 and prio > 10",
+ * 			 &expr, NULL);
+ * @endcode
+ *
+ * The expression is compiled for the object type of the cache passed
+ * in and may be used with any cache of that type.
+ *
+ * nl_expr_match_batch() evaluates one instruction across all objects
+ * of the batch before moving on to the next one, storing one result
+ * byte per object. The attribute loads are gathers through the object
+ * pointers, the gain comes from running the dispatch once per
+ * instruction instead of once per object and instruction.
+ * @{
+ */
+
+struct nl_expr;
+
+extern int		nl_expr_compile(struct nl_cache *, const char *,
+					struct nl_expr **, int *);
+extern void		nl_expr_free(struct nl_expr *);
+extern int		nl_expr_match(struct nl_expr *, struct nl_object *);
+extern int		nl_expr_match_batch(struct nl_expr *,
+					    struct nl_object **, int,
+					    uint8_t *);
+extern int		nl_expr_get_key(struct nl_expr *, uint32_t,
+					uint64_t *);
+
+extern void		nl_cache_foreach_expr(struct nl_cache *,
+					      struct nl_expr *,
+					      void (*cb)(struct nl_object *,
+							 void *),
+					      void *);
+extern struct nl_cache *nl_cache_subset_expr(struct nl_cache *,
+					     struct nl_expr *);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
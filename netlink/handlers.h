@@ -50,6 +50,42 @@ typedef int (*nl_recvmsg_msg_cb_t)(struct nl_msg *msg, void *arg);
 typedef int (*nl_recvmsg_err_cb_t)(struct sockaddr_nl *nla,
 				   struct nlmsgerr *nlerr, void *arg);
 
+/**
+ * Extended acknowledgement information
+ * @ingroup cb
+ */
+struct nl_ext_ack
+{
+	/** Error message provided by the kernel or NULL */
+	const char *		ea_msg;
+
+	/** Offset of the offending attribute in the original request
+	 * or 0 if not provided */
+	uint32_t		ea_offset;
+
+	/** Cookie provided by the kernel or NULL */
+	const void *		ea_cookie;
+
+	/** Length of the cookie */
+	size_t			ea_cookie_len;
+
+	/** Non-zero if the request was not echoed in full (NLM_F_CAPPED) */
+	int			ea_capped;
+};
+
+/**
+ * nl_recvmsgs() callback for error message processing including
+ * extended acknowledgement information
+ * @ingroup cb
+ * @arg nla		netlink address of the peer
+ * @arg nlerr		netlink error message being processed
+ * @arg ext		extended acknowledgement information
+ * @arg arg		argument passed on through caller
+ */
+typedef int (*nl_recvmsg_err_ext_cb_t)(struct sockaddr_nl *nla,
+				       struct nlmsgerr *nlerr,
+				       struct nl_ext_ack *ext, void *arg);
+
 /** @} */
 
 /**
@@ -124,6 +160,8 @@ extern int  nl_cb_set_all(struct nl_cb *, enum nl_cb_kind,
 			  nl_recvmsg_msg_cb_t, void *);
 extern int  nl_cb_err(struct nl_cb *, enum nl_cb_kind, nl_recvmsg_err_cb_t,
 		      void *);
+extern int  nl_cb_err_ext(struct nl_cb *, enum nl_cb_kind,
+			  nl_recvmsg_err_ext_cb_t, void *);
 
 extern void nl_cb_overwrite_recvmsgs(struct nl_cb *,
 				     int (*func)(struct nl_sock *,
@@ -80,6 +80,11 @@ struct nlmsghdr
  */
 #define NLM_F_ECHO		8
 
+/**
+ * Dump was inconsistent due to sequence change
+ */
+#define NLM_F_DUMP_INTR		16
+
 /** @} */
 
 /**
@@ -140,6 +145,24 @@ struct nlmsghdr
 
 /** @} */
 
+/**
+ * @name Flags for ACK messages
+ * @{
+ */
+
+/**
+ * Request was capped, the original message is not echoed in full.
+ * @ingroup msg
+ */
+#define NLM_F_CAPPED	0x100
+
+/**
+ * Extended ACK TLVs were included after the error message.
+ */
+#define NLM_F_ACK_TLVS	0x200
+
+/** @} */
+
 /**
  * @name Standard Message types
  * @{
@@ -188,6 +211,19 @@ struct nlmsgerr
 	struct nlmsghdr	msg;
 };
 
+/**
+ * Extended ACK attributes
+ * @ingroup msg
+ */
+enum nlmsgerr_attrs {
+	NLMSGERR_ATTR_UNUSED,
+	NLMSGERR_ATTR_MSG,	/**< Error message string */
+	NLMSGERR_ATTR_OFFS,	/**< Offset of the invalid attribute */
+	NLMSGERR_ATTR_COOKIE,	/**< Arbitrary subsystem specific cookie */
+	__NLMSGERR_ATTR_MAX,
+	NLMSGERR_ATTR_MAX = __NLMSGERR_ATTR_MAX - 1
+};
+
 struct nl_pktinfo
 {
 	__u32	group;
@@ -70,6 +70,18 @@ extern int			nl_recvmsgs_default(struct nl_sock *);
 
 extern int			nl_wait_for_ack(struct nl_sock *);
 
+/* Pipelined Batches */
+struct nl_batch;
+
+extern struct nl_batch *	nl_batch_alloc(struct nl_sock *);
+extern void			nl_batch_free(struct nl_batch *);
+extern int			nl_batch_add(struct nl_batch *,
+					     struct nl_msg *);
+extern void			nl_batch_set_window(struct nl_batch *, int);
+extern int			nl_batch_send(struct nl_batch *);
+extern int			nl_batch_nmsgs(struct nl_batch *);
+extern int			nl_batch_get_error(struct nl_batch *, int);
+
 /* Netlink Family Translations */
 extern char *			nl_nlfamily2str(int, char *, size_t);
 extern int			nl_str2nlfamily(const char *);
@@ -19,6 +19,8 @@
 extern "C" {
 #endif
 
+struct nl_mem_usage;
+
 /**
  * @ingroup object
  * @defgroup object_api Object API
@@ -180,6 +182,10 @@ extern "C" {
  *
  * This macro must be included as first member in every object
  * definition to allow objects to be cached.
+ *
+ * ce_refcnt is only modified through __sync atomics by nl_object_get()
+ * and nl_object_put(), readers holding nl_cache_read_lock() may take
+ * and drop references while the cache manager puts replaced objects.
  */
 #define NLHDR_COMMON				\
 	int			ce_refcnt;	\
@@ -188,7 +194,8 @@ extern "C" {
 	struct nl_list_head	ce_list;	\
 	int			ce_msgtype;	\
 	int			ce_flags;	\
-	uint32_t		ce_mask;
+	uint32_t		ce_mask;	\
+	uint64_t		ce_hash;
 
 /**
  * Return true if attribute is available in both objects
@@ -256,6 +263,56 @@ extern "C" {
 		diff = ATTR; \
 	diff; })
 
+/**
+ * Object attribute types
+ */
+enum {
+	NL_OBJ_ATTR_UNSPEC,
+	NL_OBJ_ATTR_U8,
+	NL_OBJ_ATTR_U16,
+	NL_OBJ_ATTR_U32,
+	NL_OBJ_ATTR_U64,
+	NL_OBJ_ATTR_ADDR,	/**< struct nl_addr * */
+	NL_OBJ_ATTR_STRING,	/**< inline character array */
+	__NL_OBJ_ATTR_TYPE_MAX,
+};
+
+#define NL_OBJ_ATTR_TYPE_MAX (__NL_OBJ_ATTR_TYPE_MAX - 1)
+
+/**
+ * Object attribute descriptor
+ *
+ * Describes where a simple attribute is stored within the object so
+ * that generic code such as compact filters can access it without
+ * calling into the object implementation.
+ *
+ * @code
+ * static struct nl_object_attr my_attrs[] = {
+ * 	{ MY_ATTR_FOO, NL_OBJ_ATTR_U32, offsetof(struct my_obj, foo), "foo", 0 },
+ * 	END_OF_OBJECT_ATTRS,
+ * };
+ * @endcode
+ */
+struct nl_object_attr
+{
+	/** Attribute bit */
+	uint32_t	oa_id;
+
+	/** Attribute type (NL_OBJ_ATTR_*) */
+	int		oa_type;
+
+	/** Offset of the member within the object */
+	size_t		oa_offset;
+
+	/** Name of attribute */
+	const char *	oa_name;
+
+	/** Size of the member, required for NL_OBJ_ATTR_STRING */
+	size_t		oa_size;
+};
+
+#define END_OF_OBJECT_ATTRS	{ 0, NL_OBJ_ATTR_UNSPEC, 0, NULL, 0 }
+
 /**
  * Object Operations
  */
@@ -303,6 +360,32 @@ struct nl_object_ops
 	 */
 	int  (*oo_clone)(struct nl_object *, struct nl_object *);
 
+	/**
+	 * Copy-on-write cloning function
+	 *
+	 * Like oo_clone() but must share out-of-line members such as
+	 * addresses, nexthop lists and data blobs by reference instead
+	 * of duplicating them. Members which are not reference counted
+	 * themselves must already live in a refcounted container owned
+	 * by the source, the source must not be modified apart from
+	 * atomic reference counts so that cached objects can be cloned
+	 * under nl_cache_read_lock(). The clone is marked NL_OBJ_COW and
+	 * unshares before modifying, the source unshares when it finds a
+	 * container's reference count above 1. Used by
+	 * nl_object_clone_cow(), falls back to oo_clone() if not provided.
+	 */
+	int  (*oo_clone_cow)(struct nl_object *, struct nl_object *);
+
+	/**
+	 * Unsharing function
+	 *
+	 * Will be called on objects marked NL_OBJ_COW before a setter
+	 * modifies one of the attributes given in the bitmask in place.
+	 * Must replace shared members of those attributes with private
+	 * copies. May return a negative error code.
+	 */
+	int  (*oo_unshare)(struct nl_object *, uint32_t);
+
 	/**
 	 * Dumping functions
 	 *
@@ -329,6 +412,33 @@ struct nl_object_ops
 	int   (*oo_compare)(struct nl_object *, struct nl_object *,
 			    uint32_t, int);
 
+	/**
+	 * Content hash function
+	 *
+	 * Will be called to compute a hash over the attributes given
+	 * in the bitmask. The result is stored in ce_hash at parse time
+	 * and allows nl_object_diff() to identify unchanged objects
+	 * without calling oo_compare(). Setters must clear NL_OBJ_HASHED
+	 * whenever they modify an attribute. Optional.
+	 */
+	uint64_t (*oo_hash)(struct nl_object *, uint32_t);
+
+	/**
+	 * Attribute descriptors
+	 *
+	 * Optional table describing the simple attributes of the object,
+	 * terminated by END_OF_OBJECT_ATTRS.
+	 */
+	struct nl_object_attr *	oo_attrs;
+
+	/**
+	 * Memory accounting function
+	 *
+	 * Must add the size of all out-of-line allocations owned by the
+	 * object to the counters. The fixed part (oo_size) is accounted
+	 * by the generic code. Optional.
+	 */
+	void (*oo_mem_usage)(struct nl_object *, struct nl_mem_usage *);
 
 	char *(*oo_attrs2str)(int, char *, size_t);
 };
@@ -21,6 +21,7 @@ extern "C" {
 
 struct nl_cache;
 struct nl_object;
+struct nl_addr;
 struct nl_object_ops;
 
 #define OBJ_CAST(ptr)		((struct nl_object *) (ptr))
@@ -31,6 +32,7 @@ extern int			nl_object_alloc_name(const char *,
 						     struct nl_object **);
 extern void			nl_object_free(struct nl_object *);
 extern struct nl_object *	nl_object_clone(struct nl_object *obj);
+extern struct nl_object *	nl_object_clone_cow(struct nl_object *obj);
 extern void			nl_object_get(struct nl_object *);
 extern void			nl_object_put(struct nl_object *);
 extern int			nl_object_shared(struct nl_object *);
@@ -42,12 +44,52 @@ extern uint32_t			nl_object_diff(struct nl_object *,
 					       struct nl_object *);
 extern int			nl_object_match_filter(struct nl_object *,
 						       struct nl_object *);
+extern void			nl_object_update_hash(struct nl_object *);
+extern int			nl_object_get_hash(struct nl_object *,
+						   uint64_t *);
 extern char *			nl_object_attrs2str(struct nl_object *,
 						    uint32_t attrs, char *buf,
 						    size_t);
 extern char *			nl_object_attr_list(struct nl_object *,
 						    char *, size_t);
 
+/**
+ * Memory usage of objects
+ * @ingroup object
+ *
+ * Out-of-line members referenced by several objects are accounted
+ * to each of them divided by their reference count.
+ */
+struct nl_mem_usage
+{
+	size_t		mu_inline;	/**< Fixed object size (oo_size) */
+	size_t		mu_addrs;	/**< Addresses (struct nl_addr) */
+	size_t		mu_data;	/**< Data blobs (struct nl_data) */
+	size_t		mu_lists;	/**< Nexthops, ematch trees, metrics */
+	size_t		mu_other;	/**< Type specific private data */
+};
+
+extern void			nl_object_mem_usage(struct nl_object *,
+						    struct nl_mem_usage *);
+
+/* Compact filters */
+struct nl_object_filter;
+
+extern struct nl_object_filter *nl_object_filter_alloc(struct nl_cache *);
+extern int			nl_object_filter_from_object(struct nl_object *,
+						struct nl_object_filter **);
+extern void			nl_object_filter_free(struct nl_object_filter *);
+extern int			nl_object_filter_set_uint(struct nl_object_filter *,
+							  const char *, uint64_t);
+extern int			nl_object_filter_set_addr(struct nl_object_filter *,
+							  const char *,
+							  struct nl_addr *);
+extern int			nl_object_filter_set_str(struct nl_object_filter *,
+							 const char *,
+							 const char *);
+extern int			nl_object_filter_match(struct nl_object_filter *,
+						       struct nl_object *);
+
 /* Marks */
 extern void			nl_object_mark(struct nl_object *);
 extern void			nl_object_unmark(struct nl_object *);
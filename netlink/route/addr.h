@@ -39,6 +39,38 @@ extern int	rtnl_addr_build_delete_request(struct rtnl_addr *, int,
 extern int	rtnl_addr_delete(struct nl_sock *,
 				 struct rtnl_addr *, int);
 
+/* Bulk reconciliation */
+#define RTNL_ADDR_RECONCILE_ROLLBACK	(1<<0)
+
+/**
+ * Outcome of a single address operation of a reconciliation
+ * @ingroup rtnl_addr
+ */
+struct rtnl_addr_result
+{
+	/** Address added, replaced or deleted */
+	struct rtnl_addr *	ar_addr;
+
+	/** NL_ACT_NEW, NL_ACT_CHANGE or NL_ACT_DEL */
+	int			ar_action;
+
+	/** 0 on success or a negative error code */
+	int			ar_error;
+};
+
+struct rtnl_addr_reconcile;
+
+extern struct rtnl_addr_reconcile *rtnl_addr_reconcile_alloc(struct nl_cache *);
+extern void	rtnl_addr_reconcile_free(struct rtnl_addr_reconcile *);
+extern int	rtnl_addr_reconcile_add(struct rtnl_addr_reconcile *,
+					struct rtnl_addr *);
+extern int	rtnl_addr_reconcile_add_link(struct rtnl_addr_reconcile *, int);
+extern int	rtnl_addr_reconcile_commit(struct nl_sock *,
+					   struct rtnl_addr_reconcile *, int);
+extern int	rtnl_addr_reconcile_nresults(struct rtnl_addr_reconcile *);
+extern struct rtnl_addr_result *rtnl_addr_reconcile_get_result(
+					struct rtnl_addr_reconcile *, int);
+
 extern char *	rtnl_addr_flags2str(int, char *, size_t);
 extern int	rtnl_addr_str2flags(const char *);
 
@@ -51,6 +51,12 @@ enum rtnl_link_st {
 
 #define RTNL_LINK_STATS_MAX (__RTNL_LINK_STATS_MAX - 1)
 
+/* link cache flags */
+#define RTNL_LINK_CACHE_NO_INFO	(1<<16)	/* do not parse IFLA_LINKINFO */
+#define RTNL_LINK_CACHE_FAST_EVENTS (1<<17) /* skip events which differ from
+					       the cached link in IFLA_STATS
+					       and IFLA_STATS64 only */
+
 /* link object allocation/freeage */
 extern struct rtnl_link *rtnl_link_alloc(void);
 extern void	rtnl_link_put(struct rtnl_link *);
@@ -58,6 +64,8 @@ extern void	rtnl_link_free(struct rtnl_link *);
 
 /* link cache management */
 extern int	rtnl_link_alloc_cache(struct nl_sock *, struct nl_cache **);
+extern int	rtnl_link_alloc_cache_flags(struct nl_sock *, unsigned int,
+					    struct nl_cache **);
 extern struct rtnl_link *rtnl_link_get(struct nl_cache *, int);
 extern struct rtnl_link *rtnl_link_get_by_name(struct nl_cache *, const char *);
 
@@ -0,0 +1,36 @@
+/*
+ * netlink/route/link/bonding.h	Bonding link module
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation version 2.1
+ *	of the License.
+ */
+
+#ifndef NETLINK_LINK_BONDING_H_
+#define NETLINK_LINK_BONDING_H_
+
+#include <netlink/netlink.h>
+#include <netlink/route/link.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int		rtnl_link_is_bond(struct rtnl_link *);
+
+extern int		rtnl_link_bond_set_mode(struct rtnl_link *, uint8_t);
+extern int		rtnl_link_bond_get_mode(struct rtnl_link *);
+
+extern int		rtnl_link_bond_set_miimon(struct rtnl_link *, uint32_t);
+extern int		rtnl_link_bond_get_miimon(struct rtnl_link *);
+
+extern int		rtnl_link_bond_set_active_slave(struct rtnl_link *,
+							int);
+extern int		rtnl_link_bond_get_active_slave(struct rtnl_link *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
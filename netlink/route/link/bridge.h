@@ -0,0 +1,50 @@
+/*
+ * netlink/route/link/bridge.h	Bridge link module
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation version 2.1
+ *	of the License.
+ */
+
+#ifndef NETLINK_LINK_BRIDGE_H_
+#define NETLINK_LINK_BRIDGE_H_
+
+#include <netlink/netlink.h>
+#include <netlink/route/link.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int		rtnl_link_is_bridge(struct rtnl_link *);
+
+extern int		rtnl_link_bridge_set_forward_delay(struct rtnl_link *,
+							   uint32_t);
+extern int		rtnl_link_bridge_get_forward_delay(struct rtnl_link *);
+
+extern int		rtnl_link_bridge_set_hello_time(struct rtnl_link *,
+							uint32_t);
+extern int		rtnl_link_bridge_get_hello_time(struct rtnl_link *);
+
+extern int		rtnl_link_bridge_set_max_age(struct rtnl_link *,
+						     uint32_t);
+extern int		rtnl_link_bridge_get_max_age(struct rtnl_link *);
+
+extern int		rtnl_link_bridge_set_ageing_time(struct rtnl_link *,
+							 uint32_t);
+extern int		rtnl_link_bridge_get_ageing_time(struct rtnl_link *);
+
+extern int		rtnl_link_bridge_set_stp_state(struct rtnl_link *,
+						       uint32_t);
+extern int		rtnl_link_bridge_get_stp_state(struct rtnl_link *);
+
+extern int		rtnl_link_bridge_set_priority(struct rtnl_link *,
+						      uint16_t);
+extern int		rtnl_link_bridge_get_priority(struct rtnl_link *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * netlink/route/link/veth.h	Virtual Ethernet link module
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation version 2.1
+ *	of the License.
+ */
+
+#ifndef NETLINK_LINK_VETH_H_
+#define NETLINK_LINK_VETH_H_
+
+#include <netlink/netlink.h>
+#include <netlink/route/link.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int		rtnl_link_is_veth(struct rtnl_link *);
+
+extern int		rtnl_link_veth_set_peer_name(struct rtnl_link *,
+						     const char *);
+extern char *		rtnl_link_veth_get_peer_name(struct rtnl_link *);
+
+/* Backed by IFLA_LINK, veth dumps carry no IFLA_INFO_DATA */
+extern int		rtnl_link_veth_get_peer_ifindex(struct rtnl_link *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * netlink/route/link/vxlan.h	VXLAN link module
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation version 2.1
+ *	of the License.
+ */
+
+#ifndef NETLINK_LINK_VXLAN_H_
+#define NETLINK_LINK_VXLAN_H_
+
+#include <netlink/netlink.h>
+#include <netlink/route/link.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Like the other link modules, getters return the value or a negative
+ * error code if the link is not a vxlan or the attribute is not set.
+ * The VNI is 24 bits wide and thus always fits.
+ */
+extern int		rtnl_link_is_vxlan(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_id(struct rtnl_link *, uint32_t);
+extern int		rtnl_link_vxlan_get_id(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_group(struct rtnl_link *,
+						  struct nl_addr *);
+extern struct nl_addr *	rtnl_link_vxlan_get_group(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_local(struct rtnl_link *,
+						  struct nl_addr *);
+extern struct nl_addr *	rtnl_link_vxlan_get_local(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_link(struct rtnl_link *, uint32_t);
+extern int		rtnl_link_vxlan_get_link(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_port(struct rtnl_link *, uint16_t);
+extern int		rtnl_link_vxlan_get_port(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_ttl(struct rtnl_link *, uint8_t);
+extern int		rtnl_link_vxlan_get_ttl(struct rtnl_link *);
+
+extern int		rtnl_link_vxlan_set_tos(struct rtnl_link *, uint8_t);
+extern int		rtnl_link_vxlan_get_tos(struct rtnl_link *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,6 +22,8 @@ extern "C" {
 
 struct rtnl_neightbl;
 
+#define NTBLNAMSIZ	32
+
 extern struct rtnl_neightbl *rtnl_neightbl_alloc(void);
 extern void rtnl_neightbl_put(struct rtnl_neightbl *);
 extern void rtnl_neightbl_free(struct rtnl_neightbl *);
@@ -58,6 +60,56 @@ extern void rtnl_neightbl_set_anycast_delay(struct rtnl_neightbl *, uint64_t);
 extern void rtnl_neightbl_set_proxy_delay(struct rtnl_neightbl *, uint64_t);
 extern void rtnl_neightbl_set_locktime(struct rtnl_neightbl *, uint64_t);
 
+/* Statistics sampling */
+#define RTNL_NEIGHTBL_ALARM_HASH_STORM	(1<<0)
+#define RTNL_NEIGHTBL_ALARM_GC_SOFT	(1<<1)
+#define RTNL_NEIGHTBL_ALARM_GC_HARD	(1<<2)
+#define RTNL_NEIGHTBL_ALARM_GC_FORCED	(1<<3)
+
+/**
+ * Per-interval rates of a neighbour table
+ * @ingroup neightbl
+ *
+ * All rates are in events per second over the last sampling interval.
+ * The kernel reports statistics per table only, device specific
+ * parameter sets are therefore covered by the rates of their table.
+ */
+struct rtnl_neightbl_rates
+{
+	char		nr_name[NTBLNAMSIZ];	/**< Table name */
+	uint32_t	nr_family;	/**< Address family */
+	uint64_t	nr_interval;	/**< Sampling interval in msecs */
+	uint32_t	nr_entries;	/**< Current number of entries */
+	uint32_t	nr_alarms;	/**< RTNL_NEIGHTBL_ALARM_* */
+	double		nr_allocs;
+	double		nr_destroys;
+	double		nr_hash_grows;
+	double		nr_lookups;
+	double		nr_hits;
+	double		nr_res_failed;
+	double		nr_rcv_probes_mcast;
+	double		nr_rcv_probes_ucast;
+	double		nr_periodic_gc_runs;
+	double		nr_forced_gc_runs;
+};
+
+struct rtnl_neightbl_sampler;
+
+extern struct rtnl_neightbl_sampler *rtnl_neightbl_sampler_alloc(void);
+extern void rtnl_neightbl_sampler_free(struct rtnl_neightbl_sampler *);
+extern void rtnl_neightbl_sampler_set_storm_rate(struct rtnl_neightbl_sampler *,
+						 double);
+extern int rtnl_neightbl_sampler_update(struct rtnl_neightbl_sampler *,
+					struct nl_cache *);
+extern int rtnl_neightbl_sampler_get(struct rtnl_neightbl_sampler *,
+				     const char *, int,
+				     struct rtnl_neightbl_rates *);
+extern void rtnl_neightbl_sampler_foreach(struct rtnl_neightbl_sampler *,
+					  void (*cb)(struct rtnl_neightbl_rates *,
+						     void *),
+					  void *);
+extern char *rtnl_neightbl_alarms2str(int, char *, size_t);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,38 @@ extern "C" {
 #endif
 
 struct rtnl_nexthop;
+struct rtnl_route;
+
+/* Nexthop attributes, as used by rtnl_route_nh_compare() */
+#define RTNL_ROUTE_NH_ATTR_FLAGS	0x000001
+#define RTNL_ROUTE_NH_ATTR_WEIGHT	0x000002
+#define RTNL_ROUTE_NH_ATTR_IFINDEX	0x000004
+#define RTNL_ROUTE_NH_ATTR_GATEWAY	0x000008
+#define RTNL_ROUTE_NH_ATTR_REALMS	0x000010
+
+/**
+ * Nexthop level change callback
+ * @ingroup route
+ * @arg route		route the nexthop belongs to (new version)
+ * @arg old_nh		previous nexthop or NULL if added
+ * @arg new_nh		current nexthop or NULL if removed
+ * @arg action		NL_ACT_NEW, NL_ACT_DEL or NL_ACT_CHANGE
+ * @arg diff		RTNL_ROUTE_NH_ATTR_* that changed (NL_ACT_CHANGE)
+ * @arg arg		argument passed on through caller
+ *
+ * Nexthops of the old and new route are matched by (gateway, ifindex).
+ * A changed gateway or ifindex is therefore reported as NL_ACT_DEL of
+ * the old nexthop followed by NL_ACT_NEW of the new one, and diff only
+ * ever contains RTNL_ROUTE_NH_ATTR_WEIGHT, _FLAGS and _REALMS. If
+ * several nexthops of a route share the same (gateway, ifindex), they
+ * are paired in list order; surplus ones are reported as added or
+ * removed.
+ */
+typedef void (*rtnl_route_nh_change_func_t)(struct rtnl_route *route,
+					    struct rtnl_nexthop *old_nh,
+					    struct rtnl_nexthop *new_nh,
+					    int action, uint32_t diff,
+					    void *arg);
 
 enum {
 	NH_DUMP_FROM_ONELINE = -2,
@@ -28,6 +28,7 @@ extern "C" {
 #define ROUTE_CACHE_CONTENT	1
 
 struct rtnl_route;
+struct nl_expr;
 
 struct rtnl_rtcacheinfo
 {
@@ -48,6 +49,35 @@ extern void	rtnl_route_put(struct rtnl_route *);
 extern int	rtnl_route_alloc_cache(struct nl_sock *, int, int,
 				       struct nl_cache **);
 
+/* Table partitioned route cache */
+struct rtnl_route_tables;
+
+extern int	rtnl_route_tables_alloc(struct nl_sock *, int, int,
+					struct rtnl_route_tables **);
+extern void	rtnl_route_tables_free(struct rtnl_route_tables *);
+extern struct nl_cache *rtnl_route_tables_get(struct rtnl_route_tables *,
+					      int, uint32_t);
+extern int	rtnl_route_tables_refill(struct nl_sock *,
+					 struct rtnl_route_tables *,
+					 int, uint32_t);
+extern int	rtnl_route_tables_resync(struct nl_sock *,
+					 struct rtnl_route_tables *,
+					 int, uint32_t,
+					 change_func_t, void *);
+extern int	rtnl_route_tables_include(struct rtnl_route_tables *,
+					  struct nl_object *,
+					  change_func_t, void *);
+extern void	rtnl_route_tables_foreach(struct rtnl_route_tables *,
+					  void (*cb)(struct nl_cache *, int,
+						     uint32_t, void *),
+					  void *);
+extern int	rtnl_route_tables_nitems(struct rtnl_route_tables *);
+extern void	rtnl_route_tables_foreach_expr(struct rtnl_route_tables *,
+					       struct nl_expr *,
+					       void (*cb)(struct nl_object *,
+							  void *),
+					       void *);
+
 extern void	rtnl_route_get(struct rtnl_route *);
 extern void	rtnl_route_put(struct rtnl_route *);
 
@@ -102,7 +132,19 @@ extern void	rtnl_route_foreach_nexthop(struct rtnl_route *r,
                                  void (*cb)(struct rtnl_nexthop *, void *),
                                  void *arg);
 
+extern void	rtnl_route_foreach_nexthop_const(struct rtnl_route *r,
+				void (*cb)(const struct rtnl_nexthop *, void *),
+				void *arg);
+
 extern struct rtnl_nexthop * rtnl_route_nexthop_n(struct rtnl_route *r, int n);
+extern int	rtnl_route_unshare_nexthops(struct rtnl_route *);
+
+extern int	rtnl_route_diff_nexthops(struct rtnl_route *,
+					 struct rtnl_route *,
+					 rtnl_route_nh_change_func_t, void *);
+extern int	rtnl_route_include_nh(struct nl_cache *, struct nl_object *,
+				      change_func_t,
+				      rtnl_route_nh_change_func_t, void *);
 
 extern int	rtnl_route_guess_scope(struct rtnl_route *);
 
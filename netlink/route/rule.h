@@ -38,6 +38,43 @@ extern int	rtnl_rule_build_delete_request(struct rtnl_rule *, int,
 					       struct nl_msg **);
 extern int rtnl_rule_delete(struct nl_sock *, struct rtnl_rule *, int);
 
+/* Pipelined programming */
+extern int	rtnl_rule_batch_add(struct nl_batch *, struct rtnl_rule *, int);
+extern int	rtnl_rule_batch_delete(struct nl_batch *, struct rtnl_rule *,
+				       int);
+extern int	rtnl_rule_move(struct nl_sock *, struct rtnl_rule **,
+			       const uint32_t *, int, int *);
+
+/* Priority ordered index */
+struct rtnl_rule_index;
+
+extern int	rtnl_rule_index_build(struct nl_cache *,
+				      struct rtnl_rule_index **);
+extern void	rtnl_rule_index_free(struct rtnl_rule_index *);
+extern int	rtnl_rule_index_lookup(struct rtnl_rule_index *, int,
+				       uint32_t, struct rtnl_rule ***);
+extern void	rtnl_rule_index_foreach(struct rtnl_rule_index *, int,
+					void (*cb)(struct rtnl_rule *, void *),
+					void *);
+
+/* Conflict analysis */
+enum {
+	RTNL_RULE_DUPLICATE,	/**< Same selector and action as other */
+	RTNL_RULE_SHADOWED,	/**< Never hit, other matches a superset first */
+	RTNL_RULE_OVERLAP,	/**< Selectors overlap with other */
+	RTNL_RULE_NO_TABLE,	/**< Lookup table contains no routes */
+	__RTNL_RULE_CONFLICT_MAX,
+};
+
+#define RTNL_RULE_CONFLICT_MAX (__RTNL_RULE_CONFLICT_MAX - 1)
+
+typedef void (*rtnl_rule_conflict_func_t)(int, struct rtnl_rule *,
+					  struct rtnl_rule *, void *);
+
+extern int	rtnl_rule_analyze(struct rtnl_rule_index *, struct nl_cache *,
+				  rtnl_rule_conflict_func_t, void *);
+extern char *	rtnl_rule_conflict2str(int, char *, size_t);
+
 
 /* attribute modification */
 extern void		rtnl_rule_set_family(struct rtnl_rule *, int);
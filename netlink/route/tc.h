@@ -51,6 +51,25 @@ extern int rtnl_tc_calc_cell_log(int);
 
 extern int rtnl_tc_build_rate_table(uint32_t *, uint8_t, uint8_t, int, int);
 
+/**
+ * Rate table request for rtnl_tc_build_rate_tables()
+ * @ingroup tc
+ */
+struct rtnl_tc_rate_req
+{
+	uint32_t *	rr_table;	/**< RTNL_TC_RTABLE_SIZE entries */
+	uint8_t		rr_mpu;		/**< Minimum packet unit */
+	uint8_t		rr_overhead;	/**< Per packet overhead */
+	int		rr_cell;	/**< Cell size */
+	int		rr_rate;	/**< Rate in bytes/s */
+};
+
+/* Batch calculations, results are identical to the scalar functions */
+extern void rtnl_tc_calc_txtime_batch(const int *, const int *, int *, size_t);
+extern void rtnl_tc_calc_bufsize_batch(const int *, const int *, int *, size_t);
+extern void rtnl_tc_calc_cell_log_batch(const int *, int *, size_t);
+extern int rtnl_tc_build_rate_tables(struct rtnl_tc_rate_req *, size_t);
+
 
 /* TC Handle Translations */
 extern char *		rtnl_tc_handle2str(uint32_t, char *, size_t);
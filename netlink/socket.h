@@ -46,14 +46,60 @@ extern int		nl_socket_modify_cb(struct nl_sock *, enum nl_cb_type,
 					    nl_recvmsg_msg_cb_t, void *);
 
 extern int		nl_socket_set_buffer_size(struct nl_sock *, int, int);
+
+/* Adaptive receive buffer */
+#define NL_BUFSIZE_FORCE	1	/* use SO_RCVBUFFORCE if permitted */
+
+/**
+ * Receive buffer statistics of a socket
+ * @ingroup socket
+ */
+struct nl_sock_bufstats
+{
+	int		bs_rcvbuf;	/**< Current SO_RCVBUF in bytes */
+	int		bs_min;		/**< Lower bound in adaptive mode */
+	int		bs_max;		/**< Upper bound in adaptive mode */
+	int		bs_high_water;	/**< Highest queue occupancy seen */
+	uint64_t	bs_overruns;	/**< ENOBUFS seen on receive */
+	uint64_t	bs_grows;	/**< Number of buffer increases */
+	uint64_t	bs_shrinks;	/**< Number of buffer decreases */
+};
+
+extern int		nl_socket_set_buffer_adaptive(struct nl_sock *, int,
+						      int, int);
+extern void		nl_socket_get_buffer_stats(struct nl_sock *,
+						   struct nl_sock_bufstats *);
 extern int		nl_socket_set_passcred(struct nl_sock *, int);
 extern int		nl_socket_recv_pktinfo(struct nl_sock *, int);
+extern int		nl_socket_set_ext_ack(struct nl_sock *, int);
+extern int		nl_socket_set_cap_ack(struct nl_sock *, int);
 
 extern void		nl_socket_disable_seq_check(struct nl_sock *);
 extern unsigned int	nl_socket_use_seq(struct nl_sock *);
+
+/* Shared request sockets */
+extern int		nl_socket_enable_shared(struct nl_sock *);
+extern int		nl_socket_register_seq(struct nl_sock *, unsigned int,
+					       struct nl_cb *);
+extern int		nl_socket_wait_seq(struct nl_sock *, unsigned int);
+extern int		nl_socket_dispatch(struct nl_sock *);
 extern void		nl_socket_disable_auto_ack(struct nl_sock *);
 extern void		nl_socket_enable_auto_ack(struct nl_sock *);
 
+/* Socket pools */
+struct nl_sock_pool;
+
+extern struct nl_sock_pool *nl_sock_pool_alloc(int, int);
+extern void		nl_sock_pool_free(struct nl_sock_pool *);
+extern void		nl_sock_pool_set_setup(struct nl_sock_pool *,
+					       int (*)(struct nl_sock *,
+						       void *),
+					       void *);
+extern int		nl_sock_pool_get(struct nl_sock_pool *,
+					 struct nl_sock **);
+extern void		nl_sock_pool_put(struct nl_sock_pool *,
+					 struct nl_sock *);
+
 extern int		nl_socket_get_fd(struct nl_sock *);
 extern int		nl_socket_set_nonblocking(struct nl_sock *);
 extern void		nl_socket_enable_msg_peek(struct nl_sock *);
@@ -51,6 +51,8 @@ extern long	nl_prob2int(const char *);
 extern int	nl_get_hz(void);
 extern uint32_t	nl_us2ticks(uint32_t);
 extern uint32_t	nl_ticks2us(uint32_t);
+extern void	nl_us2ticks_batch(const uint32_t *, uint32_t *, size_t);
+extern void	nl_ticks2us_batch(const uint32_t *, uint32_t *, size_t);
 extern int	nl_str2msec(const char *, uint64_t *);
 extern char *	nl_msec2str(uint64_t, char *, size_t);
 